@@ -21,6 +21,12 @@
  */
 #define DHSCAN_REGCOUNT (8)
 
+/*
+ * The number of scanlines the Delilah Scanline Renderer completes
+ * between invocations of the progress accessor function.
+ */
+#define DHSCAN_PROGRESS_ROWS (16)
+
 /*
  * The different shading modes.
  */
@@ -139,6 +145,38 @@ typedef int (*dhscan_fp_mode)(void *, int32_t);
  */
 typedef void (*dhscan_fp_clear)(void *);
 
+/*
+ * Function pointer type for progress accessor function.
+ * 
+ * This accessor is optional.  If the client provides it, it is invoked
+ * each time another DHSCAN_PROGRESS_ROWS scanlines have been completed.
+ * If the height of the output image is not a multiple of
+ * DHSCAN_PROGRESS_ROWS, it is also invoked once more after the final
+ * scanline, so that the last invocation always reports the full height
+ * exactly once.
+ * 
+ * The (void *) parameter is a custom parameter that is passed through
+ * and intended for client data.
+ * 
+ * The first int32_t parameter is the number of scanlines that have been
+ * completed so far.  The second int32_t parameter is the height in
+ * pixels of the output image, which is the total number of scanlines.
+ * 
+ * The return value is non-zero if rendering should continue, or zero
+ * if rendering should be cancelled.  When rendering is cancelled, the
+ * Delilah Scanline Renderer stops without rendering any further
+ * scanlines, and the number of completed scanlines is the value that
+ * was passed to the accessor that cancelled it.  Returning zero from
+ * the invocation that reports the full height has no effect, since the
+ * render is already complete.
+ * 
+ * Clients that need to respect a wall-clock deadline should check the
+ * clock within this accessor and cancel when the deadline has passed.
+ * This bounds the delay before cancellation to the time taken to render
+ * DHSCAN_PROGRESS_ROWS scanlines.
+ */
+typedef int (*dhscan_fp_progress)(void *, int32_t, int32_t);
+
 /*
  * Function pointer type for flat shading accessor function.
  * 
@@ -163,6 +201,34 @@ typedef void (*dhscan_fp_clear)(void *);
  */
 typedef void (*dhscan_fp_flat)(void *, int32_t, int32_t);
 
+/*
+ * Function pointer type for flat shading span accessor function.
+ * 
+ * This accessor is optional.  If the client provides it, the Delilah
+ * Scanline Renderer will use it instead of the flat shading accessor
+ * whenever a triangle in flat shading mode covers a run of consecutive
+ * pixels within a scanline.  Otherwise, the flat shading accessor is
+ * invoked once for each pixel in the run.
+ * 
+ * The (void *) parameter is a custom parameter that is passed through
+ * and intended for client data.
+ * 
+ * The first int32_t parameter is the first target pixel within the
+ * client scanline buffer.  The second int32_t parameter is the number
+ * of pixels in the run, which is always at least one.  The whole run is
+ * always in the range [0, width - 1] where width is the width in pixels
+ * of the output image.
+ * 
+ * The third int32_t parameter is the source triangle index.  It will be
+ * at least zero and less than the total number of triangles.
+ * 
+ * When this function is called, the client should have the same result
+ * as calling the flat shading accessor function for each pixel in the
+ * run.  Since the "color" of the triangle is only looked up once, the
+ * client can fill the run with bulk stores.
+ */
+typedef void (*dhscan_fp_span)(void *, int32_t, int32_t, int32_t);
+
 /*
  * Function pointer type for vertex shading load accessor function.
  * 